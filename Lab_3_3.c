@@ -1,29 +1,15 @@
 #include <stdio.h> // Standard input/output library
 #include <stdlib.h> // Standard library
 #include <string.h> // String manipulation functions
-#include <time.h> // Time functions
-
-#define MAX_TEAMS 5       // Maximum number of teams that can be enrolled
-#define MAX_PLAYERS 5    // Maximum number of players in a team
-
-// Structure to store individual player information
-struct Player {
-    char name[25];         // Player's full name
-    int kit_number;        // Unique kit number for the player (1-99)
-    char dob[50];          // Date of birth (in DD/MM/YYYY format)
-    char position[50];     // Player's position in the team (e.g., Forward, Goalkeeper)
-};
-
-// Structure to store team information, including players
-struct Team {
-    char team_name[20];            // Team's name
-    struct Player players[MAX_PLAYERS]; // Array of players in the team
-    int num_players;               // Number of players currently in the team
-};
-
-// Global variables
-struct Team teams[MAX_TEAMS];      // Array to hold all enrolled teams
-int enrolled_teams_count = 0;      // Track the number of enrolled teams
+#include "league_store.h" // Team and player storage
+#include "instrument.h" // Hot-path counters and latency histograms
+
+// Instrumented operations (see instrument.h)
+INSTR_OP(op_enroll_team, "league.enroll_team");       // Team enrollment attempts
+INSTR_OP(op_add_player, "league.add_player");         // Player add attempts
+INSTR_OP(op_search_player, "league.search_player");   // Player searches
+INSTR_OP(op_update_player, "league.update_player");   // Player updates
+INSTR_OP(op_display_stats, "league.display_stats");   // Team statistics report
 
 // Function prototypes
 void display_menu(); // Display the main menu
@@ -31,11 +17,8 @@ void enroll_team(); // Enroll a new team
 void add_player(); // Add a player to a team
 void search_and_update_player(); // Search for a player and update details
 void display_team_statistics(); // Display team statistics
-int calculate_age(const char* dob); // Calculate age from date of birth
 void handle_invalid_input(); // Handle invalid user input
 int select_team(); // Select a team from the list
-int validate_kit_number(int team_index, int kit_number); // Validate kit number
-int validate_player_name(int team_index, char* name, int player_index_to_skip); // Validate player name
 void update_player_info(int team_index, int player_index); // Update player details
 
 /**
@@ -45,6 +28,7 @@ void update_player_info(int team_index, int player_index); // Update player deta
 int main() {
     int user_choice;
 
+    INSTR_INIT(); // Report counters and latencies on exit
     // Initialize each team to have zero players initially
     for (int i = 0; i < MAX_TEAMS; i++) {
         teams[i].num_players = 0;
@@ -98,6 +82,7 @@ void display_menu() {
  * Ensures that the maximum number of teams isn't exceeded and prevents duplicate team names.
  */
 void enroll_team() {
+    INSTR_COUNT(op_enroll_team);
     if (enrolled_teams_count >= MAX_TEAMS) { // Check if max teams limit is reached
         printf("The maximum number of teams has already been enrolled.\n");
         return; // Exit the function if the limit is reached
@@ -132,6 +117,7 @@ void enroll_team() {
  * Collects player information (name, kit number, DOB, position) and ensures it is unique within the team.
  */
 void add_player() {
+    INSTR_COUNT(op_add_player);
     if (enrolled_teams_count == 0) { // Ensure there are teams to add players to
         printf("No teams have been enrolled yet. Please enroll a team first.\n");
         return; // Exit the function if no teams are enrolled
@@ -234,57 +220,11 @@ int select_team() {
     return team_choice - 1; // Convert to zero-based index
 }
 
-/**
- * Validates that a kit number is unique within the team and within the valid range (1-99).
- * parameters:-
- * team_index The index of the team
- * kit_number The kit number to validate
- * return 1 if the kit number is valid and unique, 0 otherwise.
- */
-int validate_kit_number(int team_index, int kit_number) {
-    if (kit_number < 1 || kit_number > 99) { // Check valid range
-        printf("Invalid kit number. Please enter a number between 1 and 99.\n");
-        return 0;
-    }
-
-    // Check for duplicate kit number across all teams
-    for (int i = 0; i < enrolled_teams_count; i++) {
-        for (int j = 0; j < teams[i].num_players; j++) {
-            if (teams[i].players[j].kit_number == kit_number) {
-                printf("A player with kit number %d already exists in team %s.\n", kit_number, teams[i].team_name);
-                return 0;
-            }
-        }
-    }
-    return 1; // Kit number is valid
-}
-
-
-/**
- * Validates that the player name is unique within the team.
- * team_index The index of the team
- * name The name of the player to be validated
- * return 1 if the name is a duplicate, 0 if unique.
- */
-int validate_player_name(int team_index, char* name, int player_index_to_skip) {
-    for (int i = 0; i < enrolled_teams_count; i++) {
-        for (int j = 0; j < teams[i].num_players; j++) {
-            // Skip checking the current player being updated (if applicable)
-            if (i == team_index && j == player_index_to_skip) continue;
-
-            if (strcasecmp(teams[i].players[j].name, name) == 0) {
-                printf("A player with the name %s already exists in team %s.\n", name, teams[i].team_name);
-                return 1; // Duplicate name found
-            }
-        }
-    }
-    return 0; // Name is unique
-}
-
 /**
  * Searches for a player in a team based on either kit number or name, then updates details if found.
  */
 void search_and_update_player() {
+    INSTR_COUNT(op_search_player);
     if (enrolled_teams_count == 0) {
         printf("No teams have been enrolled yet.\n");
         return;
@@ -367,6 +307,7 @@ void search_and_update_player() {
  * If a team has no players, it notifies the user.
  */
 void display_team_statistics() {
+    INSTR_SCOPE(op_display_stats);
     if (enrolled_teams_count == 0) { // Check if teams are enrolled
         printf("No teams have been enrolled yet.\n");
         return;
@@ -396,40 +337,12 @@ void display_team_statistics() {
     }
 }
 
-/*
-* Function to calculate age from date of birth (DOB).
-* parameters:-
-* dob The date of birth in the format "DD MM YYYY"
-* return The age calculated based on the current date.
-*/
-int calculate_age(const char* dob) {
-    // Variables to store date components
-    int day, month, year;
-    int current_day, current_month, current_year;
-    
-    // Parse the DOB (format: DD MM YYYY)
-    sscanf(dob, "%d %d %d", &day, &month, &year);
-    
-    // Get current date
-    time_t t = time(NULL); // Get current time
-    struct tm tm = *localtime(&t); //Get current time
-    current_day = tm.tm_mday; // Day of the month
-    current_month = tm.tm_mon + 1; // Months are 0-based
-    current_year = tm.tm_year + 1900; // Years since 1900
-
-    // Calculate age
-    int age = current_year - year;
-    if (current_month < month || (current_month == month && current_day < day)) {
-        age--; // Adjust if birthday hasn't occurred yet this year
-    }
-    return age;
-}
-
 /**
  * Updates a player's details based on user's choice (name, kit number, DOB, or position).
  * Ensures any new kit number is unique within the team.
  */
 void update_player_info(int team_index, int player_index) { 
+    INSTR_COUNT(op_update_player);
     int choice;
     printf("1. Update Name\n2. Update Kit Number\n3. Update DOB\n4. Update Position\n");
     printf("Enter your choice: ");
@@ -0,0 +1,144 @@
+#include<stdio.h> // Include the standard input/output library
+#include <stdbool.h> // Include the standard boolean library
+#include "array_toolkit.h" // Include the array and matrix operations
+#include "instrument.h" // Include the hot-path counters and latency histograms
+
+// Instrumented operations (see instrument.h)
+INSTR_OP(op_print_array, "array.print_array"); // Printing an array
+INSTR_OP(op_print_matrix, "array.print_matrix"); // Printing a matrix
+INSTR_OP(op_remove_at, "array.remove_at"); // Removing an element
+INSTR_OP(op_insert_at, "array.insert_at"); // Inserting an element
+INSTR_OP(op_reshape_array, "array.reshape_array"); // Reshaping an array into a matrix
+INSTR_OP(op_transpose_matrix, "array.transpose_matrix"); // Transposing a matrix
+INSTR_OP(op_found_duplicate, "array.found_duplicate"); // Duplicate scan
+
+// Function to print an array
+void print_array(int array[], int length){ // Function to print an array
+    INSTR_SCOPE(op_print_array); // Time this call
+    for(int i = 0; i < length; i++) // Loop through the array
+        printf("%d  ", array[i]);// Print each element
+    printf("\n");// Print a newline
+}
+
+// Function to remove an element from an array without printing; returns false if the position is invalid
+bool remove_at(int arr[], int length, int pos) {
+    INSTR_SCOPE(op_remove_at); // Time this call
+    if (!isValid(length, pos)) { // Check if the position is valid
+        return false;
+    }
+
+    for (int i = pos; i < length - 1; i++) { // Loop through the array
+        arr[i] = arr[i + 1];  // Shift elements to the left
+    }
+    return true;
+}
+
+// Function to remove an element from an array
+void remove_element(int arr[], int length, int pos) { // Function to remove an element from an array
+    if (!remove_at(arr, length, pos)) { // Remove the element if the position is valid
+        printf("Invalid position for removal: %d\n", pos); // Print an error message
+        return;
+    }
+
+    printf("After removal, array is:\n"); //
+    print_array(arr, length - 1); // Print the updated array
+}
+
+bool isValid(int length, int pos) { // Function to check if a position is valid
+    return pos >= 0 && pos < length; // Return true if the position is valid
+}
+
+// Function to insert an element into an array without printing; returns false if the position is invalid
+bool insert_at(int arr[], int length, int pos, int value) {
+    INSTR_SCOPE(op_insert_at); // Time this call
+    if (!isValid(length, pos)) { // Check if the position is valid
+        return false;
+    }
+
+    for (int i = length - 1; i > pos; i--) { // Loop through the array
+        arr[i] = arr[i - 1];// Shift elements to the right
+    }
+    
+    arr[pos] = value;  // Insert the value at the specified position
+    return true;
+}
+
+void insert_element(int arr[], int length, int pos, int value) { // Function to insert an element into an array
+    if (!insert_at(arr, length, pos, value)) { // Insert the value if the position is valid
+        printf("Invalid position for insertion: %d\n", pos);// Print an error message
+        return;
+    }
+
+    printf("After insertion, array is:\n"); 
+    print_array(arr, length); // Print the updated array
+}
+
+// Function to reshape an array into a 2D matrix without printing; returns false if the sizes do not match
+bool reshape_array(const int arr[], int length, int rows, int cols, int arr2d[rows][cols]) {
+    INSTR_SCOPE(op_reshape_array); // Time this call
+    if (length != rows * cols) { // Check if the length of the array matches the size of the matrix
+        return false;
+    }
+
+    int idx = 0; // Initialize the index
+    for (int col = 0; col < cols; col++) { // Loop through the columns
+        for (int row = 0; row < rows; row++) { // Loop through the rows
+            arr2d[row][col] = arr[idx]; // Assign the value from the array to the matrix
+            idx++; // Increment the index
+        }
+    }
+    return true;
+}
+
+// Function to reshape an array into a 2D matrix
+void reshape(const int arr[], int length, int rows, int cols, int arr2d[rows][cols]) { // Function to reshape an array into a 2D matrix
+    if (!reshape_array(arr, length, rows, cols, arr2d)) { // Reshape if the sizes match
+        printf("Error: The length of the array does not match the size of the matrix.\n"); // Print an error message
+        return;
+    }
+
+    printf("Reshaped 2D matrix:\n"); 
+    print_matrix(rows, cols, arr2d); // Print the reshaped matrix
+}
+
+// Function to print a matrix
+void print_matrix(int rows, int cols, int mat[rows][cols]){ // Function to print a matrix
+    INSTR_SCOPE(op_print_matrix); // Time this call
+    for(int i = 0; i < rows; i++) { // Loop through the rows
+        for(int j = 0; j < cols; j++) { // Loop through the columns
+            printf("%d  ", mat[i][j]);    // Print the element
+        }
+        puts(""); // Print a newline
+    }     
+}
+
+// Function to transpose a matrix without printing
+void transpose_matrix(int rows, int cols, const int mat[rows][cols], int mat_transp[cols][rows]) {
+    INSTR_SCOPE(op_transpose_matrix); // Time this call
+    for (int i = 0; i < rows; i++) { // Loop through the rows
+        for (int j = 0; j < cols; j++) { // Loop through the columns
+            mat_transp[j][i] = mat[i][j]; // Transpose the matrix
+        }
+    }
+}
+
+// Function to transpose a matrix
+void trans_matrix(int rows, int cols, const int mat[rows][cols], int mat_transp[cols][rows]) { // Function to transpose a matrix
+    transpose_matrix(rows, cols, mat, mat_transp); // Transpose the matrix
+
+    printf("Transposed matrix:\n");
+    print_matrix(cols, rows, mat_transp); // Print the transposed matrix
+}
+
+// Function to check for duplicates in an array
+bool found_duplicate(int arr[], int length) { // Function to check for duplicates in an array
+    INSTR_SCOPE(op_found_duplicate); // Time this call
+    for (int i = 0; i < length - 1; i++) { // Loop through the array
+        for (int j = i + 1; j < length; j++) { // Loop through the remaining elements
+            if (arr[i] == arr[j]) { // Check for duplicates
+                return true; // Return true if a duplicate is found
+            }
+        }
+    }
+    return false; // Return false if no duplicates are found
+}
@@ -0,0 +1,22 @@
+#ifndef ARRAY_TOOLKIT_H
+#define ARRAY_TOOLKIT_H
+
+#include <stdbool.h> // Include the standard boolean library
+
+// Function prototypes
+void print_array(int array[], int length); // Function to print an array
+void print_matrix(int rows, int cols, int mat[rows][cols]); // Function to print a matrix
+bool isValid(int length, int pos); // Function to check if a position is valid
+void remove_element(int arr[], int length, int pos); // Function to remove an element from an array
+void insert_element(int arr[], int length, int pos, int value); // Function to insert an element into an array
+void reshape(const int arr[], int length, int rows, int cols, int arr2d[rows][cols]); // Function to reshape an array into a 2D matrix
+void trans_matrix(int rows, int cols, const int mat[rows][cols], int mat_transp[cols][rows]); // Function to transpose a matrix
+bool found_duplicate(int arr[], int length); // Function to check for duplicates in an array
+
+// Quiet cores of the operations above; they do the work without printing
+bool remove_at(int arr[], int length, int pos); // Remove an element; false if the position is invalid
+bool insert_at(int arr[], int length, int pos, int value); // Insert an element; false if the position is invalid
+bool reshape_array(const int arr[], int length, int rows, int cols, int arr2d[rows][cols]); // Reshape; false if the sizes do not match
+void transpose_matrix(int rows, int cols, const int mat[rows][cols], int mat_transp[cols][rows]); // Transpose a matrix
+
+#endif
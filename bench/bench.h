@@ -0,0 +1,59 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdio.h> // freopen
+#include <stdlib.h> // atoi
+#include "instrument.h" // Timer, histograms and report
+
+#define BENCH_DEFAULT_ITERATIONS 100000 // Iterations per benchmark when none are given
+#define BENCH_BATCH 32 // Calls per sample for operations too short to time one at a time
+
+/*
+ * Shared helpers for the module microbenchmarks.
+ * Each benchmark is a `struct instr_op` whose histogram is filled by BENCH_RUN;
+ * the report printed at exit (see instrument.h) holds the results.
+ * The modules are linked from copies built with INSTR_DISABLE (see
+ * CMakeLists.txt), so the samples hold no nested instrumentation; the harness
+ * calls the instr_* functions directly to do its own timing.
+ */
+
+#define BENCH_OP(var, label) INSTR_DEFINE_OP(var, label)
+
+// Time `stmt` once per iteration and record every sample into `op`
+#define BENCH_RUN(op, iterations, stmt) \
+    for (int bench_i = 0; bench_i < (iterations); bench_i++) { \
+        instr_tick_t bench_start = instr_now(); \
+        stmt; \
+        instr_record(&(op), instr_now() - bench_start); \
+    }
+
+/*
+ * Time BENCH_BATCH back-to-back runs of `stmt` per iteration and record the
+ * per-call average, so the timer's own cost is spread over the whole batch.
+ */
+#define BENCH_RUN_BATCH(op, iterations, stmt) \
+    for (int bench_i = 0; bench_i < (iterations); bench_i++) { \
+        instr_tick_t bench_start = instr_now(); \
+        for (int bench_j = 0; bench_j < BENCH_BATCH; bench_j++) { \
+            stmt; \
+        } \
+        instr_record(&(op), (instr_now() - bench_start) / BENCH_BATCH); \
+    }
+
+/*
+ * Function to prepare a benchmark run.
+ * Reads the iteration count from the first argument, silences stdout because
+ * the modules print their results, and arms the report on stderr.
+ */
+static inline int bench_init(int argc, char *argv[]) {
+    int iterations = argc > 1 ? atoi(argv[1]) : BENCH_DEFAULT_ITERATIONS;
+    if (iterations <= 0) iterations = BENCH_DEFAULT_ITERATIONS;
+    if (freopen("/dev/null", "w", stdout) == NULL) {
+        fprintf(stderr, "Could not redirect stdout; benchmark output will be printed.\n");
+    }
+    instr_init();
+    fprintf(stderr, "== %s ==\n", argv[0]);
+    return iterations;
+}
+
+#endif
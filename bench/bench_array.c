@@ -0,0 +1,46 @@
+#include <stdbool.h> // Include the standard boolean library
+#include "array_toolkit.h" // Include the array and matrix operations
+#include "bench.h" // Include the benchmark helpers
+
+#define NROWS 8    // Define the number of rows in the matrix
+#define NCOLS 3    // Define the number of columns in the matrix
+#define SIZE (NROWS * NCOLS) // Define the size of the array
+
+BENCH_OP(bench_remove_insert, "bench.remove_insert");
+BENCH_OP(bench_reshape, "bench.reshape_array");
+BENCH_OP(bench_transpose, "bench.transpose_matrix");
+BENCH_OP(bench_duplicate_early, "bench.found_duplicate.early");
+BENCH_OP(bench_duplicate_none, "bench.found_duplicate.none");
+BENCH_OP(bench_print_array, "bench.io.print_array"); // I/O-bound: stdio formatting cost
+BENCH_OP(bench_print_matrix, "bench.io.print_matrix"); // I/O-bound: stdio formatting cost
+
+static volatile bool sink; // Keeps results alive
+
+int main(int argc, char *argv[]) {
+    int iterations = bench_init(argc, argv);
+
+    int arr[SIZE]; // Array with a duplicate at the front
+    int unique[SIZE]; // Array without duplicates (worst case for the scan)
+    for (int i = 0; i < SIZE; i++) {
+        arr[i] = (i % 5 + 1) * 10;
+        unique[i] = i;
+    }
+    int arr2d[NROWS][NCOLS]; // Reshaped matrix
+    int mat_transp[NCOLS][NROWS]; // Transposed matrix
+
+    // Compute-only cores, timed in batches because each call takes well under 100 ns
+    BENCH_RUN_BATCH(bench_remove_insert, iterations, {
+        sink = remove_at(arr, SIZE, 2);
+        sink = insert_at(arr, SIZE, 2, 80);
+    });
+    BENCH_RUN_BATCH(bench_reshape, iterations, sink = reshape_array(arr, SIZE, NROWS, NCOLS, arr2d));
+    BENCH_RUN_BATCH(bench_transpose, iterations, transpose_matrix(NROWS, NCOLS, arr2d, mat_transp));
+    BENCH_RUN_BATCH(bench_duplicate_early, iterations, sink = found_duplicate(arr, SIZE));
+    BENCH_RUN_BATCH(bench_duplicate_none, iterations, sink = found_duplicate(unique, SIZE));
+
+    // Printing, which is dominated by stdio formatting rather than the toolkit
+    BENCH_RUN(bench_print_array, iterations, print_array(arr, SIZE));
+    BENCH_RUN(bench_print_matrix, iterations, print_matrix(NROWS, NCOLS, arr2d));
+
+    return 0;
+}
@@ -0,0 +1,42 @@
+#include <stdio.h> // Standard input/output library
+#include "league_store.h" // Team and player storage
+#include "bench.h" // Benchmark helpers
+
+BENCH_OP(bench_validate_kit, "bench.validate_kit");
+BENCH_OP(bench_validate_name, "bench.validate_name");
+BENCH_OP(bench_calculate_age, "bench.calculate_age");
+
+static volatile int sink; // Keeps results alive
+
+/*
+ * Fills every team to capacity so the validation scans walk the whole league.
+ * Kit numbers run from 1 to MAX_TEAMS * MAX_PLAYERS.
+ */
+static void fill_league(void) {
+    for (int i = 0; i < MAX_TEAMS; i++) {
+        snprintf(teams[i].team_name, sizeof(teams[i].team_name), "Team %d", i + 1);
+        for (int j = 0; j < MAX_PLAYERS; j++) {
+            struct Player *player = &teams[i].players[j];
+            snprintf(player->name, sizeof(player->name), "Player %d-%d", i + 1, j + 1);
+            player->kit_number = i * MAX_PLAYERS + j + 1;
+            snprintf(player->dob, sizeof(player->dob), "%02d %02d %d", j + 1, i + 1, 1990 + j);
+            snprintf(player->position, sizeof(player->position), "Forward");
+        }
+        teams[i].num_players = MAX_PLAYERS;
+    }
+    enrolled_teams_count = MAX_TEAMS;
+}
+
+int main(int argc, char *argv[]) {
+    int iterations = bench_init(argc, argv);
+    fill_league();
+
+    char new_name[] = "Unenrolled Player"; // Name that is not in the league
+
+    // The validation scans are short, so they are timed in batches
+    BENCH_RUN_BATCH(bench_validate_kit, iterations, sink = validate_kit_number(0, 99));
+    BENCH_RUN_BATCH(bench_validate_name, iterations, sink = validate_player_name(0, new_name, -1));
+    BENCH_RUN(bench_calculate_age, iterations, sink = calculate_age(teams[0].players[0].dob));
+
+    return 0;
+}
@@ -0,0 +1,34 @@
+#include "ledger.h" // Transaction processing
+#include "bench.h" // Benchmark helpers
+
+#define NUM_TRANSACTIONS 1024 // Transactions per batch
+
+BENCH_OP(bench_batch_applied, "bench.batch.applied");
+BENCH_OP(bench_batch_rejected, "bench.batch.rejected");
+
+static volatile int sink; // Keeps results alive
+
+int main(int argc, char *argv[]) {
+    int iterations = bench_init(argc, argv) / 100; // Each iteration is a whole batch
+    if (iterations == 0) iterations = 1;
+
+    int transactions[NUM_TRANSACTIONS]; // Alternating withdrawals and deposits
+    int tobeprocessed[NUM_TRANSACTIONS]; // Transactions that were not applied
+    for (int i = 0; i < NUM_TRANSACTIONS; i++) {
+        transactions[i] = (i % 2 == 0) ? -300 : 270;
+    }
+
+    // Large balance: every transaction is applied
+    BENCH_RUN(bench_batch_applied, iterations, {
+        int balance = 1000000;
+        sink = apply_transactions(transactions, NUM_TRANSACTIONS, &balance, tobeprocessed);
+    });
+
+    // Small balance: the account drifts down until some withdrawals are rejected
+    BENCH_RUN(bench_batch_rejected, iterations, {
+        int balance = 1000;
+        sink = apply_transactions(transactions, NUM_TRANSACTIONS, &balance, tobeprocessed);
+    });
+
+    return 0;
+}
@@ -0,0 +1,192 @@
+#define _POSIX_C_SOURCE 200809L // clock_gettime and sigaction
+
+#include "instrument.h" // Instrumentation API
+#include <signal.h> // Signal handling
+#include <stdlib.h> // atexit
+#include <time.h> // clock_gettime
+#include <unistd.h> // write, STDERR_FILENO
+
+static struct instr_op *ops_head = NULL; // Registered operations
+static instr_tick_t start_ticks;         // Timer value when instr_init ran
+static instr_tick_t start_ns;            // Monotonic time when instr_init ran
+static volatile sig_atomic_t reported = 0; // Set once the report has been written
+
+/*
+ * Function to map a sample onto its histogram bucket.
+ * Values below 2^INSTR_SUB_BITS get one bucket each; above that every power
+ * of two is split into 2^INSTR_SUB_BITS equal sub-buckets.
+ */
+static int bucket_index(instr_tick_t value) {
+    if (value < (1ULL << INSTR_SUB_BITS)) {
+        return (int)value;
+    }
+    int exponent = 63 - __builtin_clzll(value); // Position of the highest set bit
+    int sub = (int)((value >> (exponent - INSTR_SUB_BITS)) & ((1ULL << INSTR_SUB_BITS) - 1));
+    return ((exponent - INSTR_SUB_BITS + 1) << INSTR_SUB_BITS) + sub;
+}
+
+/*
+ * Function to get the largest value that falls into a bucket.
+ * Percentiles are reported as this upper bound so they never understate latency.
+ */
+static instr_tick_t bucket_upper(int index) {
+    if (index < (1 << INSTR_SUB_BITS)) {
+        return (instr_tick_t)index;
+    }
+    int exponent = (index >> INSTR_SUB_BITS) + INSTR_SUB_BITS - 1;
+    instr_tick_t sub = (instr_tick_t)(index & ((1 << INSTR_SUB_BITS) - 1));
+    instr_tick_t width = 1ULL << (exponent - INSTR_SUB_BITS);
+    return (((1ULL << INSTR_SUB_BITS) + sub) << (exponent - INSTR_SUB_BITS)) + width - 1;
+}
+
+void instr_register(struct instr_op *op) {
+    op->min = ~0ULL;
+    op->next = ops_head; // Runs from constructors, before main, so no signal can see a partial list
+    ops_head = op;
+}
+
+instr_tick_t instr_now_slow(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts); // Monotonic clock, unaffected by date changes
+    return (instr_tick_t)ts.tv_sec * 1000000000ULL + (instr_tick_t)ts.tv_nsec;
+}
+
+void instr_record(struct instr_op *op, instr_tick_t ticks) {
+    op->samples++;
+    op->total += ticks;
+    if (ticks < op->min) op->min = ticks;
+    if (ticks > op->max) op->max = ticks;
+    op->buckets[bucket_index(ticks)]++;
+}
+
+void instr_count(struct instr_op *op, unsigned long long n) {
+    op->events += n;
+}
+
+/*
+ * Function to find the smallest bucket bound covering the given fraction
+ * of an operation's samples.
+ */
+static instr_tick_t percentile(const struct instr_op *op, double fraction) {
+    double rank = fraction * (double)op->samples;
+    unsigned long long target = (unsigned long long)rank;
+    if ((double)target < rank || target == 0) target++; // Round the rank up
+    unsigned long long seen = 0;
+    for (int i = 0; i < INSTR_BUCKETS; i++) {
+        seen += op->buckets[i];
+        if (seen >= target) {
+            instr_tick_t upper = bucket_upper(i);
+            return upper < op->max ? upper : op->max; // Never report more than the true maximum
+        }
+    }
+    return op->max;
+}
+
+/*
+ * Function to append a string to a report line, left-aligned and padded to width.
+ * Returns the new line length.
+ */
+static size_t put_str(char *line, size_t len, size_t size, const char *str, int width) {
+    int written = 0;
+    for (; *str != '\0' && len < size; str++, written++) {
+        line[len++] = *str;
+    }
+    for (; written < width && len < size; written++) {
+        line[len++] = ' ';
+    }
+    return len;
+}
+
+/*
+ * Function to append an unsigned number to a report line, right-aligned to width
+ * and preceded by one space. Returns the new line length.
+ */
+static size_t put_uint(char *line, size_t len, size_t size, unsigned long long value, int width) {
+    char digits[24];
+    int count = 0;
+    do {
+        digits[count++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    if (len < size) line[len++] = ' ';
+    for (int pad = width - count; pad > 0 && len < size; pad--) {
+        line[len++] = ' ';
+    }
+    while (count > 0 && len < size) {
+        line[len++] = digits[--count];
+    }
+    return len;
+}
+
+/*
+ * Writes one line per operation that has been used. Lines are formatted by hand into a
+ * stack buffer and sent with write(), without stdio, so the report can also be
+ * produced from a signal handler.
+ */
+void instr_report(int fd) {
+    char line[256];
+    size_t len;
+    const size_t size = sizeof(line) - 1; // Room left for the trailing newline
+
+    // Work out how many nanoseconds one timer tick is worth over the whole run
+    double ns_per_tick = 1.0;
+#ifdef INSTR_HAVE_TSC
+    instr_tick_t elapsed_ticks = instr_now() - start_ticks;
+    instr_tick_t elapsed_ns = instr_now_slow() - start_ns;
+    if (elapsed_ticks > 0 && elapsed_ns > 0) {
+        ns_per_tick = (double)elapsed_ns / (double)elapsed_ticks;
+    }
+#endif
+
+    static const char header[] =
+        "\n--- Instrumentation report (latency in ns) ---\n"
+        "operation                        events    samples       mean        p50        p99      p99.9        max\n";
+    if (write(fd, header, sizeof(header) - 1) < 0) return;
+
+    for (const struct instr_op *op = ops_head; op != NULL; op = op->next) {
+        if (op->events == 0 && op->samples == 0) continue; // Never used
+        len = put_str(line, 0, size, op->name, 28);
+        len = put_uint(line, len, size, op->events, 10);
+        if (op->samples == 0) { // Counter only
+            len = put_str(line, len, size, "          -", 0);
+        } else {
+            len = put_uint(line, len, size, op->samples, 10);
+            len = put_uint(line, len, size, (unsigned long long)((double)op->total / (double)op->samples * ns_per_tick + 0.5), 10);
+            len = put_uint(line, len, size, (unsigned long long)((double)percentile(op, 0.50) * ns_per_tick + 0.5), 10);
+            len = put_uint(line, len, size, (unsigned long long)((double)percentile(op, 0.99) * ns_per_tick + 0.5), 10);
+            len = put_uint(line, len, size, (unsigned long long)((double)percentile(op, 0.999) * ns_per_tick + 0.5), 10);
+            len = put_uint(line, len, size, (unsigned long long)((double)op->max * ns_per_tick + 0.5), 10);
+        }
+        line[len++] = '\n';
+        if (write(fd, line, len) < 0) return;
+    }
+}
+
+// Function to print the report once, whichever of exit or a signal comes first
+static void report_once(void) {
+    if (reported) return;
+    reported = 1;
+    instr_report(STDERR_FILENO);
+}
+
+// Function to dump the report on SIGINT/SIGTERM and then terminate as usual
+static void handle_signal(int sig) {
+    report_once();
+    signal(sig, SIG_DFL); // Restore the default action
+    raise(sig);           // Terminate with the original signal
+}
+
+void instr_init(void) {
+    start_ticks = instr_now();
+    start_ns = instr_now_slow();
+    atexit(report_once);
+
+    struct sigaction action = { 0 };
+    action.sa_handler = handle_signal;
+    sigemptyset(&action.sa_mask);
+    sigaddset(&action.sa_mask, SIGINT);  // Neither signal may interrupt the other's report
+    sigaddset(&action.sa_mask, SIGTERM);
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+}
@@ -0,0 +1,102 @@
+#ifndef INSTRUMENT_H
+#define INSTRUMENT_H
+
+/*
+ * Lightweight hot-path instrumentation shared by the lab programs.
+ *
+ * Each instrumented operation is a static `struct instr_op` declared with
+ * INSTR_OP(). INSTR_SCOPE() times the rest of the enclosing block into the
+ * operation's latency histogram and INSTR_COUNT() bumps a plain event counter.
+ * INSTR_INIT() (called once from main) arms a report that is printed to stderr
+ * when the program exits or is stopped by SIGINT/SIGTERM.
+ *
+ * Operations register themselves before main runs (GCC/Clang constructor
+ * attribute), so the report never sees the operation list change under it.
+ *
+ * Build with -DINSTR_DISABLE (CMake: -DLAB3_INSTRUMENT=OFF) to compile every
+ * macro away.
+ */
+
+#define INSTR_SUB_BITS 3 // Sub-buckets per power of two (2^3 = 8, about 12.5% precision)
+#define INSTR_BUCKETS ((64 - INSTR_SUB_BITS + 1) << INSTR_SUB_BITS) // Buckets covering the full 64-bit range
+
+typedef unsigned long long instr_tick_t; // Raw timer value (TSC cycles or nanoseconds)
+
+// Counters and latency histogram for one instrumented operation
+struct instr_op {
+    const char *name;                          // Label printed in the report
+    unsigned long long events;                 // Plain event counter (INSTR_COUNT)
+    unsigned long long samples;                // Number of timed samples (INSTR_SCOPE)
+    instr_tick_t total;                        // Sum of all samples
+    instr_tick_t min;                          // Smallest sample
+    instr_tick_t max;                          // Largest sample
+    unsigned long long buckets[INSTR_BUCKETS]; // Log-linear latency histogram
+    struct instr_op *next;                     // Link in the list of registered operations
+};
+
+// A running timer; closed automatically when it goes out of scope
+struct instr_scope {
+    struct instr_op *op;  // Operation being timed
+    instr_tick_t start;   // Timer value when the scope was entered
+};
+
+void instr_init(void); // Install the exit and signal report hooks
+void instr_register(struct instr_op *op); // Link an operation into the report
+void instr_record(struct instr_op *op, instr_tick_t ticks); // Add one timed sample
+void instr_count(struct instr_op *op, unsigned long long n); // Add n events
+void instr_report(int fd); // Write the report to a file descriptor
+instr_tick_t instr_now_slow(void); // Monotonic clock in nanoseconds
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define INSTR_HAVE_TSC 1
+#endif
+
+/*
+ * Reads the cheapest available timer. On x86 this is the time-stamp counter;
+ * elsewhere it falls back to the monotonic clock in nanoseconds.
+ */
+static inline instr_tick_t instr_now(void) {
+#ifdef INSTR_HAVE_TSC
+    return __rdtsc();
+#else
+    return instr_now_slow();
+#endif
+}
+
+static inline void instr_scope_end(struct instr_scope *scope) {
+    instr_record(scope->op, instr_now() - scope->start); // Record elapsed time
+}
+
+#define INSTR_CAT_(a, b) a##b
+#define INSTR_CAT(a, b) INSTR_CAT_(a, b)
+
+/*
+ * Defines a static operation and registers it at load time. Always available,
+ * even with INSTR_DISABLE, for code that records samples explicitly.
+ */
+#define INSTR_DEFINE_OP(var, label) \
+    static struct instr_op var; \
+    __attribute__((constructor)) static void INSTR_CAT(instr_register_, var)(void) { instr_register(&var); } \
+    static struct instr_op var = { .name = label }
+
+#ifndef INSTR_DISABLE
+
+#define INSTR_INIT() instr_init()
+#define INSTR_OP(var, label) INSTR_DEFINE_OP(var, label)
+#define INSTR_COUNT(var) instr_count(&(var), 1)
+
+#define INSTR_SCOPE(var) \
+    struct instr_scope INSTR_CAT(instr_scope_, __LINE__) \
+        __attribute__((cleanup(instr_scope_end))) = { &(var), instr_now() }
+
+#else
+
+#define INSTR_INIT() ((void)0)
+#define INSTR_OP(var, label) typedef int INSTR_CAT(instr_disabled_, var)
+#define INSTR_COUNT(var) ((void)0)
+#define INSTR_SCOPE(var) ((void)0)
+
+#endif
+
+#endif
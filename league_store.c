@@ -0,0 +1,93 @@
+#include <stdio.h> // Standard input/output library
+#include <string.h> // String manipulation functions
+#include <time.h> // Time functions
+#include "league_store.h" // Team and player storage
+#include "instrument.h" // Hot-path counters and latency histograms
+
+// Global variables
+struct Team teams[MAX_TEAMS];      // Array to hold all enrolled teams
+int enrolled_teams_count = 0;      // Track the number of enrolled teams
+
+// Instrumented operations (see instrument.h)
+INSTR_OP(op_validate_kit, "league.validate_kit");     // Kit number validation scan
+INSTR_OP(op_validate_name, "league.validate_name");   // Player name validation scan
+INSTR_OP(op_calculate_age, "league.calculate_age");   // Age calculation from DOB
+
+/**
+ * Validates that a kit number is unique within the team and within the valid range (1-99).
+ * parameters:-
+ * team_index The index of the team
+ * kit_number The kit number to validate
+ * return 1 if the kit number is valid and unique, 0 otherwise.
+ */
+int validate_kit_number(int team_index, int kit_number) {
+    INSTR_SCOPE(op_validate_kit);
+    if (kit_number < 1 || kit_number > 99) { // Check valid range
+        printf("Invalid kit number. Please enter a number between 1 and 99.\n");
+        return 0;
+    }
+
+    // Check for duplicate kit number across all teams
+    for (int i = 0; i < enrolled_teams_count; i++) {
+        for (int j = 0; j < teams[i].num_players; j++) {
+            if (teams[i].players[j].kit_number == kit_number) {
+                printf("A player with kit number %d already exists in team %s.\n", kit_number, teams[i].team_name);
+                return 0;
+            }
+        }
+    }
+    return 1; // Kit number is valid
+}
+
+
+/**
+ * Validates that the player name is unique within the team.
+ * team_index The index of the team
+ * name The name of the player to be validated
+ * return 1 if the name is a duplicate, 0 if unique.
+ */
+int validate_player_name(int team_index, char* name, int player_index_to_skip) {
+    INSTR_SCOPE(op_validate_name);
+    for (int i = 0; i < enrolled_teams_count; i++) {
+        for (int j = 0; j < teams[i].num_players; j++) {
+            // Skip checking the current player being updated (if applicable)
+            if (i == team_index && j == player_index_to_skip) continue;
+
+            if (strcasecmp(teams[i].players[j].name, name) == 0) {
+                printf("A player with the name %s already exists in team %s.\n", name, teams[i].team_name);
+                return 1; // Duplicate name found
+            }
+        }
+    }
+    return 0; // Name is unique
+}
+
+/*
+* Function to calculate age from date of birth (DOB).
+* parameters:-
+* dob The date of birth in the format "DD MM YYYY"
+* return The age calculated based on the current date.
+*/
+int calculate_age(const char* dob) {
+    INSTR_SCOPE(op_calculate_age);
+    // Variables to store date components
+    int day, month, year;
+    int current_day, current_month, current_year;
+    
+    // Parse the DOB (format: DD MM YYYY)
+    sscanf(dob, "%d %d %d", &day, &month, &year);
+    
+    // Get current date
+    time_t t = time(NULL); // Get current time
+    struct tm tm = *localtime(&t); //Get current time
+    current_day = tm.tm_mday; // Day of the month
+    current_month = tm.tm_mon + 1; // Months are 0-based
+    current_year = tm.tm_year + 1900; // Years since 1900
+
+    // Calculate age
+    int age = current_year - year;
+    if (current_month < month || (current_month == month && current_day < day)) {
+        age--; // Adjust if birthday hasn't occurred yet this year
+    }
+    return age;
+}
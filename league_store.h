@@ -0,0 +1,36 @@
+#ifndef LEAGUE_STORE_H
+#define LEAGUE_STORE_H
+
+/*
+ * Team and player storage for the League Team Application.
+ * Holds the enrolled teams and the checks shared by the menu actions.
+ */
+
+#define MAX_TEAMS 5       // Maximum number of teams that can be enrolled
+#define MAX_PLAYERS 5    // Maximum number of players in a team
+
+// Structure to store individual player information
+struct Player {
+    char name[25];         // Player's full name
+    int kit_number;        // Unique kit number for the player (1-99)
+    char dob[50];          // Date of birth (in DD/MM/YYYY format)
+    char position[50];     // Player's position in the team (e.g., Forward, Goalkeeper)
+};
+
+// Structure to store team information, including players
+struct Team {
+    char team_name[20];            // Team's name
+    struct Player players[MAX_PLAYERS]; // Array of players in the team
+    int num_players;               // Number of players currently in the team
+};
+
+// Global variables
+extern struct Team teams[MAX_TEAMS];      // Array to hold all enrolled teams
+extern int enrolled_teams_count;          // Track the number of enrolled teams
+
+// Function prototypes
+int calculate_age(const char* dob); // Calculate age from date of birth
+int validate_kit_number(int team_index, int kit_number); // Validate kit number
+int validate_player_name(int team_index, char* name, int player_index_to_skip); // Validate player name
+
+#endif
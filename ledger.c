@@ -0,0 +1,84 @@
+#include <stdio.h>
+#include "ledger.h" // Transaction processing
+#include "instrument.h" // Hot-path counters and latency histograms
+
+// Instrumented operations (see instrument.h)
+INSTR_OP(op_transaction, "ledger.transaction"); // Processing one transaction
+INSTR_OP(op_applied, "ledger.applied");         // Transactions applied to the balance
+INSTR_OP(op_rejected, "ledger.rejected");       // Withdrawals rejected for insufficient balance
+INSTR_OP(op_halted, "ledger.halted");           // Processing stopped at zero balance
+
+// Outcome of applying one transaction
+enum tx_result {
+    TX_APPLIED,  // Balance updated
+    TX_REJECTED, // Withdrawal larger than the balance
+    TX_HALTED    // Balance is 0; no further transactions are processed
+};
+
+/*
+ * Applies one transaction to the balance without printing.
+ * Returns whether it was applied, rejected for insufficient balance, or refused
+ * because the balance has reached 0. Kept static so both loops below inline it.
+ */
+static enum tx_result apply_transaction(int *balance, int amount) {
+    INSTR_SCOPE(op_transaction); // Time this transaction
+    // Check if the transaction is a withdrawal and if there is enough balance
+    if (amount < 0 && *balance + amount < 0) { // Withdrawal and insufficient balance
+        INSTR_COUNT(op_rejected);
+        return TX_REJECTED;
+    }
+    // If balance reaches 0, stop processing further transactions
+    if (*balance == 0) { // Balance is 0
+        INSTR_COUNT(op_halted);
+        return TX_HALTED;
+    }
+    // Valid transaction: update balance
+    *balance += amount;
+    INSTR_COUNT(op_applied);
+    return TX_APPLIED;
+}
+
+/*
+ * Applies transactions to the balance in order without printing.
+ * Withdrawals that would overdraw the account are skipped, and processing stops
+ * once the balance reaches 0. Every transaction not applied is copied to tobeprocessed.
+ * Returns the number of unprocessed transactions.
+ */
+int apply_transactions(const int transactions[], int num_transactions, int *balance, int tobeprocessed[]) {
+    int tobeprocessed_count = 0; // Count of unprocessed transactions
+
+    for (int i = 0; i < num_transactions; i++) {
+        enum tx_result result = apply_transaction(balance, transactions[i]);
+        if (result != TX_APPLIED) {
+            tobeprocessed[tobeprocessed_count++] = transactions[i]; // Add the transaction to the unprocessed list
+        }
+        if (result == TX_HALTED) {
+            break; // Stop processing further transactions
+        }
+    }
+
+    return tobeprocessed_count;
+}
+
+/*
+ * Same as apply_transactions, but prints a message for every transaction
+ * that is not applied.
+ */
+int process_transactions(const int transactions[], int num_transactions, int *balance, int tobeprocessed[]) {
+    int tobeprocessed_count = 0; // Count of unprocessed transactions
+
+    for (int i = 0; i < num_transactions; i++) {
+        enum tx_result result = apply_transaction(balance, transactions[i]);
+        if (result == TX_REJECTED) {
+            printf("Invalid transaction: %d. Insufficient balance.\n", transactions[i]); // Print error message
+            tobeprocessed[tobeprocessed_count++] = transactions[i];  // Add the transaction to the unprocessed list
+        }
+        else if (result == TX_HALTED) {
+            printf("Balance is 0. No further transactions will be processed.\n"); // Print message
+            tobeprocessed[tobeprocessed_count++] = transactions[i]; // Add the transaction to the unprocessed list
+            break; // Stop processing further transactions
+        }
+    }
+
+    return tobeprocessed_count;
+}
@@ -0,0 +1,10 @@
+#ifndef LEDGER_H
+#define LEDGER_H
+
+// Process transactions against a balance and collect the ones that were not applied (quiet core)
+int apply_transactions(const int transactions[], int num_transactions, int *balance, int tobeprocessed[]);
+
+// Same as apply_transactions, printing a message for each transaction that is not applied
+int process_transactions(const int transactions[], int num_transactions, int *balance, int tobeprocessed[]);
+
+#endif